@@ -55,8 +55,8 @@ private:
 
    //------------------------------------
 
-   static const int bufferSize = 47+256;
-   // totals 512 bytes under g++ for igzstream at the end.
+   static const int bufferSize = 65536;
+   // larger than the original 47+256 to reduce the number of gzread calls
 
    //------------------------------------
    gzFile           file;